@@ -12,6 +12,10 @@ class BCMap : public platypus::NamedFieldsMap<platypus::BoundaryCondition>
 public:
   mfem::Array<int> GetEssentialBdrMarkers(const std::string & name_, mfem::Mesh * mesh_);
 
+  /// Returns true if the values of any essential BC applied to the variable may change between
+  /// steps.
+  bool EssentialBCsAreTimeDependent(const std::string & name_);
+
   void ApplyEssentialBCs(const std::string & name_,
                          mfem::Array<int> & ess_tdof_list,
                          mfem::GridFunction & gridfunc,
@@ -31,6 +35,31 @@ public:
   void ApplyIntegratedBCs(const std::string & name_,
                           mfem::ParSesquilinearForm & clf,
                           mfem::Mesh * mesh_);
+
+protected:
+  /// Invalidate the stored essential BC data when boundary conditions are registered or
+  /// deregistered.
+  void OnFieldsChanged() override { _essential_bc_data.clear(); }
+
+private:
+  // Essential BCs applied to a variable, with their combined boundary markers and essential
+  // true DoFs, which are found once and reused until the FE space is updated.
+  struct EssentialBCData
+  {
+    std::vector<std::shared_ptr<platypus::EssentialBC>> bcs;
+    mfem::Array<int> markers;
+    mfem::Array<int> ess_tdof_list;
+    const mfem::FiniteElementSpace * fespace{nullptr};
+    long fespace_sequence{-1};
+  };
+
+  EssentialBCData & GetEssentialBCData(const std::string & name_, mfem::Mesh * mesh_);
+
+  const mfem::Array<int> & GetEssentialTrueDofs(const std::string & name_,
+                                                mfem::FiniteElementSpace & fespace,
+                                                mfem::Mesh * mesh_);
+
+  std::map<std::string, EssentialBCData> _essential_bc_data;
 };
 
 } // namespace platypus
@@ -11,6 +11,10 @@ public:
 
   virtual void ApplyBC(mfem::GridFunction & gridfunc, mfem::Mesh * mesh_) {}
   virtual void ApplyBC(mfem::ParComplexGridFunction & gridfunc, mfem::Mesh * mesh_) {}
+
+  // Returns true if the boundary values may change between steps, in which case they must be
+  // re-projected at each step. Defaults to true.
+  virtual bool IsTimeDependent() const { return true; }
 };
 
 } // namespace platypus
@@ -15,6 +15,8 @@ public:
 
   void ApplyBC(mfem::GridFunction & gridfunc, mfem::Mesh * mesh_) override;
 
+  bool IsTimeDependent() const override;
+
   mfem::Coefficient * _coeff{nullptr};
   mfem::Coefficient * _coeff_im{nullptr};
 };
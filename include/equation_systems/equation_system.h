@@ -1,8 +1,11 @@
 #pragma once
+#include <algorithm>
 #include "../common/pfem_extras.hpp"
 #include "inputs.h"
 #include "named_fields_map.h"
 #include "MFEMKernel.h"
+#include "threaded_assembly.h"
+#include "variable_block_operator.h"
 
 namespace platypus
 {
@@ -60,15 +63,56 @@ public:
                  const std::string & test_var_name,
                  std::shared_ptr<MFEMMixedBilinearFormKernel> mblf_kernel);
 
+  // Set the assembly level of bilinear forms, before forms are built
+  void SetAssemblyLevel(mfem::AssemblyLevel assembly_level) { _assembly_level = assembly_level; }
+
+  // Use partial assembly if all elements are tensor-product and of at least min_order
+  void SetAutoAssemblyLevel(int min_order) { _auto_assembly_min_order = min_order; }
+
+  // Combine kernels acting on the same bilinear form into one element pass where supported
+  void SetFuseKernels(bool fuse_kernels) { _fuse_kernels = fuse_kernels; }
+
+  // Rebuild the Jacobian every refresh_iterations Newton iterations and refresh_steps solves
+  void SetJacobianRefresh(int refresh_iterations, int refresh_steps)
+  {
+    _jacobian_refresh_iterations = refresh_iterations;
+    _jacobian_refresh_steps = refresh_steps;
+  }
+
+  // Apply the Jacobian by finite differences, preconditioned by an assembled approximation
+  void SetJacobianFree(bool jacobian_free, bool precondition_with_linear_part)
+  {
+    _jacobian_free = jacobian_free;
+    _precondition_with_linear_part = precondition_with_linear_part;
+  }
+
+  // Reduce uncoupled, linear H1 variables by static condensation and RT variables by hybridization
+  void SetStaticCondensation(bool static_condensation)
+  {
+    _static_condensation = static_condensation;
+  }
+  void SetHybridization(bool hybridization) { _hybridization = hybridization; }
+
+  // Expose the system as a block operator rather than a monolithic matrix
+  void SetUseBlockOperator(bool use_block_operator) { _use_block_operator = use_block_operator; }
+
+  // Returns true if bilinear forms are not assembled into hypre matrices
+  bool IsMatrixFree() const
+  {
+    return _assembly_level != mfem::AssemblyLevel::LEGACY &&
+           _assembly_level != mfem::AssemblyLevel::FULL;
+  }
+
   virtual void ApplyBoundaryConditions(platypus::BCMap & bc_map);
 
-  // Build forms
+  // Build forms; later calls only reassemble forms with time-dependent kernels
   virtual void Init(platypus::GridFunctions & gridfunctions,
                     const platypus::FESpaces & fespaces,
                     platypus::BCMap & bc_map);
   virtual void BuildLinearForms(platypus::BCMap & bc_map);
   virtual void BuildBilinearForms();
   virtual void BuildMixedBilinearForms();
+  virtual void BuildNonlinearForms();
   virtual void BuildEquationSystem(platypus::BCMap & bc_map);
 
   // Form linear system, with essential boundary conditions accounted for
@@ -79,17 +123,33 @@ public:
   // Build linear system, with essential boundary conditions accounted for
   virtual void BuildJacobian(mfem::BlockVector & trueX, mfem::BlockVector & trueRHS);
 
-  /// Compute residual y = Mu
+  /// Compute residual y = Mu + H(u)
   void Mult(const mfem::Vector & u, mfem::Vector & residual) const override;
 
   /// Compute J = M + grad_H(u)
   mfem::Operator & GetGradient(const mfem::Vector & u) const override;
 
+  // Wrap solver so it is only set up again when the Jacobian has been rebuilt
+  mfem::Solver & GetJacobianSolver(mfem::Solver & solver, mfem::Solver * preconditioner = nullptr);
+
+  // Bilinear forms whose weighted sum is the linear diagonal block of variable i
+  virtual std::vector<std::pair<mfem::ParBilinearForm *, double>>
+  GetDiagonalBlockForms(int i) const;
+
+  // Create unassembled copies of the diagonal block forms of variable i on fespace
+  virtual std::vector<std::pair<std::unique_ptr<mfem::ParBilinearForm>, double>>
+  CreateDiagonalBlockForms(int i, mfem::ParFiniteElementSpace & fespace) const;
+
+  // Relative difference made by the quadrature order of a kernel when last checked
+  double GetQuadratureDifference(const std::string & kernel_name) const;
+
   // Update variable from solution vector after solve
   virtual void RecoverFEMSolution(mfem::BlockVector & trueX,
                                   platypus::GridFunctions & gridfunctions);
 
   std::vector<mfem::Array<int>> _ess_tdof_lists;
+  // Markers of the boundary attributes with essential BCs of each test variable
+  std::vector<mfem::Array<int>> _ess_bdr_markers;
 
   /**
    * Template method for storing kernels.
@@ -110,14 +170,212 @@ public:
   }
 
 protected:
+  class JacobianSolver;
+  class JacobianFreeOperator;
+
   bool VectorContainsName(const std::vector<std::string> & the_vector,
                           const std::string & name) const;
 
+  // Returns true if any of the kernels may change in time
+  template <class T>
+  bool KernelsAreTimeDependent(const std::vector<std::shared_ptr<T>> & kernels) const
+  {
+    return std::any_of(kernels.begin(),
+                       kernels.end(),
+                       [](const std::shared_ptr<T> & kernel) { return kernel->isTimeDependent(); });
+  }
+
+  // Returns true if kernels acting on the same bilinear form are fused
+  bool FuseKernels() const { return _fuse_kernels && !IsMatrixFree(); }
+
+  // Returns true if partial assembly is expected to be cheaper for the test spaces
+  bool PartialAssemblyIsEfficient() const;
+
+  // Returns the kernels of a test variable, or an empty vector if there are none
+  template <class T>
+  const std::vector<std::shared_ptr<T>> &
+  GetKernels(const platypus::NamedFieldsMap<std::vector<std::shared_ptr<T>>> & kernels_map,
+             const std::string & test_var_name) const
+  {
+    static const std::vector<std::shared_ptr<T>> no_kernels;
+    return kernels_map.Has(test_var_name) ? kernels_map.GetRef(test_var_name) : no_kernels;
+  }
+
+  // Delete block (i, j) so that it is formed again from its form
+  void ResetBlock(int i, int j);
+
+  // Form diagonal block i from blf with essential DoFs eliminated, if not yet stored
+  void FormDiagonalBlock(int i, mfem::ParBilinearForm & blf);
+
+  // Store op constrained on the essential DoFs as matrix-free diagonal block i, taking ownership
+  void FormMatrixFreeDiagonalBlock(int i, mfem::Operator * op);
+
+  // Mixed bilinear forms do not support element assembly
+  mfem::AssemblyLevel GetMixedAssemblyLevel() const
+  {
+    if (!IsMatrixFree())
+    {
+      return mfem::AssemblyLevel::LEGACY;
+    }
+    return _assembly_level == mfem::AssemblyLevel::ELEMENT ? mfem::AssemblyLevel::PARTIAL
+                                                           : _assembly_level;
+  }
+
+  // Form the true DoF vectors X and B of diagonal block i
+  void FormDiagonalBlockVectors(
+      int i, const mfem::Vector & x, const mfem::Vector & b, mfem::Vector & X, mfem::Vector & B);
+
+  // Set the system operator from the stored blocks, if any have been reset
+  void FormSystemOperator(mfem::OperatorHandle & op);
+
+  // Set op to the system operator arranged from assembled blocks it does not own
+  void FormAssembledSystemOperator(mfem::OperatorHandle & op,
+                                   mfem::Array2D<mfem::HypreParMatrix *> & blocks) const;
+
+  // Enable static condensation or hybridization on the form of test variable i, if requested
+  void EnableReduction(int i, mfem::ParBilinearForm & blf);
+
+  // Returns true if the interior DoFs of test variable i are eliminated
+  bool IsReduced(int i) const;
+
+  // Number of true DoFs of test variable i in the system
+  int GetSystemTrueVSize(int i) const;
+
+  // Form the reduced diagonal block i and its true DoF vectors X and B
+  void FormReducedDiagonalBlock(int i,
+                                mfem::ParBilinearForm & blf,
+                                mfem::Vector & x,
+                                const mfem::Vector & b,
+                                mfem::Vector & X,
+                                mfem::Vector & B);
+
+  // Returns true if any test variable has nonlinear kernels
+  bool HasNonlinearForms() const { return _nlfs.begin() != _nlfs.end(); }
+
+  // Returns true if the gradients of nonlinear forms are assembled
+  bool AssemblesNonlinearGradients() const
+  {
+    return !_jacobian_free || !_precondition_with_linear_part;
+  }
+
+  // Compute the assembled J = M + grad_H(u), unless the previous J is reused
+  mfem::Operator & GetAssembledGradient(const mfem::Vector & u) const;
+
+  // State u at which the nonlinear form of test variable i is evaluated, given its trial DoFs x
+  virtual void GetNonlinearState(int i, const mfem::Vector & x, mfem::Vector & u) const { u = x; }
+
+  // Factor by which nonlinear form contributions are added to the residual
+  virtual double NonlinearResidualScale() const { return 1.0; }
+
+  // Derivative of the nonlinear state u with respect to the trial variable x
+  virtual double NonlinearStateDerivative() const { return 1.0; }
+
+  // Returns the work reassembling a finalized form in place over num_threads threads
+  std::function<void()>
+  PrepareReassembly(mfem::ParBilinearForm & blf,
+                    const std::vector<std::shared_ptr<MFEMBilinearFormKernel>> & kernels,
+                    int num_threads) const;
+  std::function<void()>
+  PrepareReassembly(mfem::ParMixedBilinearForm & mblf,
+                    mfem::ParFiniteElementSpace & trial_fes,
+                    mfem::ParFiniteElementSpace & test_fes,
+                    const std::vector<std::shared_ptr<MFEMMixedBilinearFormKernel>> & kernels,
+                    int num_threads) const;
+
+  // Returns true if the form has only domain integrators, so it can be assembled over threads
+  bool HasOnlyDomainIntegrators(mfem::ParBilinearForm & blf) const;
+  bool HasOnlyDomainIntegrators(mfem::ParMixedBilinearForm & mblf) const;
+
+  // Assemble a linear form, over threads where available
+  void AssembleLinearForm(mfem::ParLinearForm & lf,
+                          const std::vector<std::shared_ptr<MFEMLinearFormKernel>> & kernels);
+
+  // Create the integrators of each thread; thread 0 applies the form's own integrators
+  template <class T>
+  ThreadIntegrators<T>
+  CreateThreadIntegrators(mfem::Array<T *> & form_integrators,
+                          const std::vector<std::shared_ptr<MFEMKernel<T>>> & kernels,
+                          mfem::ParMesh & mesh,
+                          bool fuse,
+                          int num_threads,
+                          std::vector<std::unique_ptr<T>> & owned_integrators) const;
+
+  // Create the domain integrators of kernels, with the markers of their blocks if restricted
+  template <class T>
+  std::vector<std::pair<T *, mfem::Array<int> *>>
+  CreateDomainIntegrators(const std::vector<std::shared_ptr<MFEMKernel<T>>> & kernels,
+                          mfem::ParMesh & mesh,
+                          bool fuse) const;
+
+  // Add the domain integrators of kernels to form
+  template <class FormType, class T>
+  void AddDomainIntegrators(FormType & form,
+                            const std::vector<std::shared_ptr<MFEMKernel<T>>> & kernels,
+                            mfem::ParMesh & mesh,
+                            bool fuse) const;
+
+  // Create an unassembled bilinear form on fespace from the kernels of var_name, if any
+  std::unique_ptr<mfem::ParBilinearForm> CreateBilinearForm(
+      mfem::ParFiniteElementSpace & fespace,
+      const platypus::NamedFieldsMap<std::vector<std::shared_ptr<MFEMBilinearFormKernel>>> &
+          kernels_map,
+      const std::string & var_name) const;
+
+  // Create the integrator of a kernel with its quadrature order, if set
+  template <class T>
+  T * CreateIntegrator(MFEMKernel<T> & kernel, mfem::ParMesh & mesh) const
+  {
+    auto integrator = kernel.createIntegrator();
+    if (kernel.getQuadratureOrder() >= 0)
+    {
+      integrator->SetIntRule(&GetQuadratureRule(mesh, kernel.getQuadratureOrder()));
+    }
+    return integrator;
+  }
+
+  const mfem::IntegrationRule & GetQuadratureRule(mfem::ParMesh & mesh, int order) const;
+
+  // Report the difference made by the quadrature order of a kernel, if requested
+  template <class FormType, class T, class... FormArgs>
+  void CheckQuadratureOrder(MFEMKernel<T> & kernel, FormArgs... form_args) const;
+
+  void ReportQuadratureDifference(const std::string & kernel_name,
+                                  int order,
+                                  const mfem::Vector & reduced,
+                                  const mfem::Vector & reference) const;
+
+  // Relative differences reported by the quadrature order check of each kernel
+  mutable std::map<std::string, double> _quadrature_differences;
+
+  // Space sequence of each test variable when this system last applied its essential BCs
+  std::vector<long> _ess_bc_sequences;
+
   // gridfunctions for setting Dirichlet BCs
   std::vector<std::unique_ptr<mfem::ParGridFunction>> _xs;
   std::vector<std::unique_ptr<mfem::ParGridFunction>> _dxdts;
 
+  // Assembled blocks with essential DoFs eliminated, and their eliminated parts
   mfem::Array2D<mfem::HypreParMatrix *> _h_blocks;
+  mfem::Array2D<mfem::HypreParMatrix *> _h_blocks_e;
+
+  // Constrained blocks used in place of _h_blocks when matrix-free
+  mfem::Array2D<mfem::Operator *> _mf_blocks;
+  mfem::Array<int> _block_true_offsets;
+  // Set when a block has been reset since the system operator was last formed
+  bool _blocks_changed{true};
+
+  mfem::AssemblyLevel _assembly_level{mfem::AssemblyLevel::LEGACY};
+  // Minimum order for partial assembly to be chosen automatically, or zero
+  int _auto_assembly_min_order{0};
+  bool _use_block_operator{false};
+  bool _fuse_kernels{false};
+  bool _static_condensation{false};
+  bool _hybridization{false};
+
+  // Trace spaces of hybridized variables, and the RHS of reduced variables
+  std::vector<std::unique_ptr<mfem::FiniteElementCollection>> _trace_fecs;
+  std::vector<std::unique_ptr<mfem::ParFiniteElementSpace>> _trace_fespaces;
+  std::vector<mfem::Vector> _reduced_rhs;
 
   // Arrays to store kernels to act on each component of weak form. Named
   // according to test variable
@@ -125,13 +383,35 @@ protected:
 
   platypus::NamedFieldsMap<std::vector<std::shared_ptr<MFEMLinearFormKernel>>> _lf_kernels_map;
 
+  // Linear form kernels reassembled at each step, and the stored values of the others
+  platypus::NamedFieldsMap<std::vector<std::shared_ptr<MFEMLinearFormKernel>>>
+      _dynamic_lf_kernels_map;
+  platypus::NamedFieldsMap<mfem::Vector> _static_lf_values;
+
   platypus::NamedFieldsMap<std::vector<std::shared_ptr<MFEMNonlinearFormKernel>>> _nlf_kernels_map;
 
   platypus::NamedFieldsMap<
       platypus::NamedFieldsMap<std::vector<std::shared_ptr<MFEMMixedBilinearFormKernel>>>>
       _mblf_kernels_map_map;
 
+  // Operator of the linear part of the system, with essential DoFs eliminated
   mutable mfem::OperatorHandle _jacobian;
+
+  // Jacobian of systems with nonlinear kernels, and its diagonal blocks
+  mutable mfem::OperatorHandle _gradient;
+  mutable std::vector<std::unique_ptr<mfem::HypreParMatrix>> _gradient_blocks;
+  int _jacobian_refresh_iterations{1};
+  int _jacobian_refresh_steps{1};
+  // Newton iterations in the current solve, and solves since the Jacobian was rebuilt
+  mutable int _newton_iterations{0};
+  int _solves_since_refresh{0};
+  // Incremented whenever the Jacobian changes
+  mutable int _jacobian_sequence{0};
+  std::unique_ptr<JacobianSolver> _jacobian_solver;
+
+  bool _jacobian_free{false};
+  bool _precondition_with_linear_part{false};
+  mutable std::unique_ptr<JacobianFreeOperator> _jacobian_free_operator;
 };
 
 /*
@@ -161,6 +441,23 @@ public:
   virtual void FormLinearSystem(mfem::OperatorHandle & op,
                                 mfem::BlockVector & truedXdt,
                                 mfem::BlockVector & trueRHS) override;
+  std::vector<std::pair<mfem::ParBilinearForm *, double>>
+  GetDiagonalBlockForms(int i) const override;
+  std::vector<std::pair<std::unique_ptr<mfem::ParBilinearForm>, double>>
+  CreateDiagonalBlockForms(int i, mfem::ParFiniteElementSpace & fespace) const override;
+
+protected:
+  // Nonlinear forms act on u = u_n + dt du/dt
+  void GetNonlinearState(int i, const mfem::Vector & x, mfem::Vector & u) const override;
+  double NonlinearResidualScale() const override { return -1.0; }
+  double NonlinearStateDerivative() const override { return _dt_coef.constant; }
+
+  // Set when the timestep has changed since the implicit operator was last assembled
+  bool _dt_changed{false};
+  // Unscaled values of the time derivative forms whose integrators are unchanged between steps
+  platypus::NamedFieldsMap<mfem::Vector> _td_blf_values;
+  // Index of each entry of the forms acting on u in the entries of the time derivative forms
+  platypus::NamedFieldsMap<mfem::Array<int>> _blf_value_indices;
 };
 
 } // namespace platypus
@@ -0,0 +1,57 @@
+#pragma once
+#include "mfem.hpp"
+#include <functional>
+#include <vector>
+
+namespace platypus
+{
+
+/*
+Helpers to assemble the domain integrators of forms over elements in parallel using OpenMP
+threads within each MPI rank. MFEM finite elements and integrators keep scratch data in mutable
+members unless MFEM is built with MFEM_THREAD_SAFE, so threaded assembly is only enabled when both
+OpenMP and MFEM_THREAD_SAFE are available; otherwise elements are assembled serially.
+
+Element contributions are computed in parallel in batches, then added to the global matrix or
+vector serially in element order, so the result is bit-for-bit identical to serial assembly
+regardless of the number of threads.
+*/
+
+/// Integrators applied by each thread. Integrators are not thread-safe, so each thread applies its
+/// own copy of every domain integrator of the form, in the same order as the form's integrators.
+template <class T>
+using ThreadIntegrators = std::vector<std::vector<T *>>;
+
+/// Returns the number of threads available for element assembly.
+int GetNumAssemblyThreads();
+
+/// An independent assembly task, such as the reassembly of the form of one variable. The task is
+/// called serially with the number of threads it may assemble its elements over, and must create
+/// its integrators then, so that kernels are never used by several tasks at once. It returns the
+/// assembly work, which may run concurrently with that of other tasks.
+using AssemblyTask = std::function<std::function<void()>(int num_threads)>;
+
+/// Run assembly tasks. If concurrent is true and there are several tasks, their work is run
+/// concurrently over a team of at most one thread per task, and the remaining threads are shared
+/// between the tasks to assemble their elements in nested parallel regions. Otherwise the work of
+/// each task is run in turn over all threads.
+void RunAssemblyTasks(const std::vector<AssemblyTask> & tasks, bool concurrent = true);
+
+/// Add the contributions of the domain integrators to mat, which must already contain the
+/// sparsity pattern of the form. If mixed is true, the integrators are applied as mixed integrators
+/// between the trial and test spaces.
+void AssembleDomainIntegrators(
+    const ThreadIntegrators<mfem::BilinearFormIntegrator> & integrators,
+    const mfem::Array<mfem::Array<int> *> & markers,
+    mfem::ParFiniteElementSpace & trial_fes,
+    mfem::ParFiniteElementSpace & test_fes,
+    bool mixed,
+    mfem::SparseMatrix & mat);
+
+/// Add the contributions of the domain integrators to the local vector b.
+void AssembleDomainIntegrators(const ThreadIntegrators<mfem::LinearFormIntegrator> & integrators,
+                               const mfem::Array<mfem::Array<int> *> & markers,
+                               mfem::ParFiniteElementSpace & fes,
+                               mfem::Vector & b);
+
+} // namespace platypus
@@ -0,0 +1,26 @@
+#pragma once
+#include "mfem.hpp"
+#include <string>
+#include <vector>
+
+namespace platypus
+{
+
+/// Block operator of an equation system that records the variable of each block row and column,
+/// so that solvers can assign sub-solvers to blocks by variable name.
+class VariableBlockOperator : public mfem::BlockOperator
+{
+public:
+  VariableBlockOperator(const mfem::Array<int> & offsets, std::vector<std::string> variable_names)
+    : mfem::BlockOperator(offsets), _variable_names(std::move(variable_names))
+  {
+  }
+
+  /// Returns the names of the variables, in block order.
+  const std::vector<std::string> & GetVariableNames() const { return _variable_names; }
+
+private:
+  std::vector<std::string> _variable_names;
+};
+
+} // namespace platypus
@@ -0,0 +1,50 @@
+#pragma once
+#include "mfem.hpp"
+#include <vector>
+
+namespace platypus
+{
+
+/*
+Bilinear form integrator applying the terms of several kernels acting on the same form in a
+single pass over the quadrature points of each element, so the element transformation and
+each kind of basis evaluation is computed once per point rather than once per term.
+
+All terms are integrated with the rule of the highest order required by any of the terms,
+unless a rule is set with SetIntRule.
+*/
+class FusedIntegrator : public mfem::BilinearFormIntegrator
+{
+public:
+  enum class Term
+  {
+    MASS,           // (Q u, v) on scalar spaces
+    DIFFUSION,      // (Q ∇u, ∇v) on scalar spaces
+    VECTOR_FE_MASS, // (Q u, v) on vector spaces
+    CURL_CURL       // (Q ∇×u, ∇×v) on vector spaces
+  };
+
+  /// Add a term scaled by the coefficient, which must outlive the integrator.
+  void AddTerm(Term term, mfem::Coefficient & coef);
+
+  /// Returns the number of terms that have been added.
+  int NumTerms() const { return _terms.size(); }
+
+  void AssembleElementMatrix(const mfem::FiniteElement & el,
+                             mfem::ElementTransformation & Trans,
+                             mfem::DenseMatrix & elmat) override;
+
+protected:
+  /// Returns the quadrature rule used in the absence of a rule set with SetIntRule.
+  const mfem::IntegrationRule & GetDefaultRule(const mfem::FiniteElement & el,
+                                               mfem::ElementTransformation & Trans) const;
+
+private:
+  std::vector<std::pair<Term, mfem::Coefficient *>> _terms;
+  bool _needs_shape{false}, _needs_dshape{false}, _needs_vshape{false}, _needs_curlshape{false};
+
+  mfem::Vector _shape;
+  mfem::DenseMatrix _dshape, _vshape, _curlshape;
+};
+
+} // namespace platypus
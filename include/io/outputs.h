@@ -62,6 +62,11 @@ public:
     MPI_Barrier(_my_comm);
     // Update cycle counter
     _cycle++;
+    // Outputs are written from host memory; solution data stays on the device between outputs
+    for (auto & gridfunction : *_gridfunctions)
+    {
+      gridfunction.second->HostRead();
+    }
     // Output timestep summary to console
     WriteConsoleSummary(_my_rank, t);
     if (_use_glvis)
@@ -1,10 +1,10 @@
 #pragma once
-#include "MFEMKernel.h"
+#include "MFEMScalarCoefficientKernel.h"
 
 /*
 (σ ∇ q, ∇ q')
 */
-class MFEMDiffusionKernel : public MFEMKernel<mfem::BilinearFormIntegrator>
+class MFEMDiffusionKernel : public MFEMScalarCoefficientKernel
 {
 public:
   static InputParameters validParams();
@@ -14,6 +14,8 @@ public:
   virtual mfem::BilinearFormIntegrator * createIntegrator() override;
 
 protected:
-  std::string _coef_name;
-  mfem::Coefficient & _coef;
+  virtual std::optional<platypus::FusedIntegrator::Term> getFusedTerm() const override
+  {
+    return platypus::FusedIntegrator::Term::DIFFUSION;
+  }
 };
@@ -1,12 +1,14 @@
 #pragma once
 
 #include "MFEMGeneralUserObject.h"
+#include "MooseUtils.h"
 #include "gridfunctions.h"
+#include "fused_integrator.h"
+#include "mesh_extras.hpp"
 
 /*
-Class to construct an MFEM integrator to apply to the equation system.
-
-TODO: Support for marker arrays specifying the block each kernel is applied on.
+Class to construct an MFEM integrator to apply to the equation system, optionally restricted to
+a subset of the mesh blocks.
 */
 template <typename T>
 class MFEMKernel : public MFEMGeneralUserObject
@@ -18,12 +20,47 @@ public:
     params.registerBase("Kernel");
     params.addParam<std::string>("variable",
                                  "Variable labelling the weak form this kernel is added to");
+    params.addParam<std::vector<SubdomainName>>(
+        "block",
+        "The list of blocks (ids) the kernel is applied on. Defaults to the whole mesh.");
+    params.addRangeCheckedParam<int>(
+        "quadrature_order",
+        "quadrature_order>=0",
+        "Order of the quadrature rule used by the integrator. Defaults to the rule chosen by the "
+        "integrator from the orders of the elements and of the mesh transformation.");
+    params.addParam<bool>(
+        "check_quadrature_order",
+        false,
+        "Report the relative difference between the contribution of the kernel assembled with "
+        "quadrature_order and with the default rule when the kernel is first assembled.");
     return params;
   }
 
   MFEMKernel(const InputParameters & parameters)
-    : MFEMGeneralUserObject(parameters), _test_var_name(getParam<std::string>("variable"))
+    : MFEMGeneralUserObject(parameters),
+      _test_var_name(getParam<std::string>("variable")),
+      _quadrature_order(isParamValid("quadrature_order") ? getParam<int>("quadrature_order") : -1),
+      _check_quadrature_order(getParam<bool>("check_quadrature_order"))
   {
+    if (isParamValid("block"))
+    {
+      for (const auto & block : getParam<std::vector<SubdomainName>>("block"))
+      {
+        // MFEM meshes identify blocks by their attribute alone, so blocks cannot be named
+        try
+        {
+          _subdomain_attributes.Append(MooseUtils::convert<int>(block, true));
+        }
+        catch (const std::exception &)
+        {
+          paramError("block", "Block '", block, "' is not a positive integer block id.");
+        }
+      }
+    }
+    if (_check_quadrature_order && _quadrature_order < 0)
+    {
+      paramError("check_quadrature_order", "Requires quadrature_order to be set.");
+    }
   }
   virtual ~MFEMKernel() = default;
 
@@ -37,7 +74,59 @@ public:
   // Defaults to the name of the test variable labelling the weak form.
   virtual const std::string & getTrialVariableName() const { return _test_var_name; }
 
+  // Returns true if the integrator created by this kernel may change between timesteps, in which
+  // case the form the kernel is added to must be reassembled at each step. Defaults to true.
+  virtual bool isTimeDependent() const { return true; }
+
+  // Add the contribution of the kernel as a term of an integrator applying the kernels of a form
+  // in a single element pass. Returns false if the kernel cannot be fused, in which case its own
+  // integrator is used.
+  virtual bool addFusedTerm(platypus::FusedIntegrator & integrator) const { return false; }
+
+  // Returns true if the kernel is only applied on a subset of the mesh blocks.
+  bool isSubdomainRestricted() const { return _subdomain_attributes.Size() > 0; }
+
+  // Build the markers of the element attributes the kernel is applied on, if not yet built, and
+  // return them to restrict forms to. The markers persist for the lifetime of the kernel. Must not
+  // be called concurrently.
+  mfem::Array<int> & buildElementMarkers(const mfem::ParMesh & mesh)
+  {
+    if (_element_markers.Size() != mesh.attributes.Max())
+    {
+      for (const int attribute : _subdomain_attributes)
+      {
+        if (mesh.attributes.Find(attribute) < 0)
+        {
+          paramError("block", "Block ", attribute, " is not a block of the mesh.");
+        }
+      }
+      mfem::common::AttrToMarker(mesh.attributes.Max(), _subdomain_attributes, _element_markers);
+    }
+    return _element_markers;
+  }
+
+  // Get the markers of the element attributes the kernel is applied on, once built.
+  const mfem::Array<int> & getElementMarkers() const
+  {
+    mooseAssert(_element_markers.Size() > 0, "Element markers have not been built");
+    return _element_markers;
+  }
+
+  // Get the order of the quadrature rule used by the integrator, or -1 to use the integrator's
+  // default rule.
+  int getQuadratureOrder() const { return _quadrature_order; }
+
+  // Returns true if the kernel's quadrature rule should be compared against the default rule.
+  bool checkQuadratureOrder() const { return _check_quadrature_order; }
+
 protected:
   // Name of (the test variable associated with) the weak form that the kernel is applied to.
   std::string _test_var_name;
+
+  int _quadrature_order;
+  bool _check_quadrature_order;
+
+  // Attributes of the blocks the kernel is applied on, or empty if applied on the whole mesh.
+  mfem::Array<int> _subdomain_attributes;
+  mfem::Array<int> _element_markers;
 };
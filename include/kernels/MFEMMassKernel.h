@@ -1,10 +1,10 @@
 #pragma once
-#include "MFEMKernel.h"
+#include "MFEMScalarCoefficientKernel.h"
 
 /*
 (βu, u')
 */
-class MFEMMassKernel : public MFEMKernel<mfem::BilinearFormIntegrator>
+class MFEMMassKernel : public MFEMScalarCoefficientKernel
 {
 public:
   static InputParameters validParams();
@@ -15,6 +15,8 @@ public:
   virtual mfem::BilinearFormIntegrator * createIntegrator() override;
 
 protected:
-  std::string _coef_name;
-  mfem::Coefficient & _coef;
+  virtual std::optional<platypus::FusedIntegrator::Term> getFusedTerm() const override
+  {
+    return platypus::FusedIntegrator::Term::MASS;
+  }
 };
@@ -1,10 +1,10 @@
 #pragma once
-#include "MFEMKernel.h"
+#include "MFEMScalarCoefficientKernel.h"
 
 /*
 (σ ∇ V, u')
 */
-class MFEMMixedVectorGradientKernel : public MFEMKernel<mfem::BilinearFormIntegrator>
+class MFEMMixedVectorGradientKernel : public MFEMScalarCoefficientKernel
 {
 public:
   static InputParameters validParams();
@@ -13,8 +13,4 @@ public:
   ~MFEMMixedVectorGradientKernel() override = default;
 
   virtual mfem::BilinearFormIntegrator * createIntegrator() override;
-
-protected:
-  std::string _coef_name;
-  mfem::Coefficient & _coef;
 };
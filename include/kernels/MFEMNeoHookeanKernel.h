@@ -0,0 +1,20 @@
+#pragma once
+#include "MFEMKernel.h"
+
+/*
+(∂W/∂F(u), ∇u') for the Neo-Hookean strain energy density W with shear modulus μ and bulk
+modulus K
+*/
+class MFEMNeoHookeanKernel : public MFEMKernel<mfem::NonlinearFormIntegrator>
+{
+public:
+  static InputParameters validParams();
+
+  MFEMNeoHookeanKernel(const InputParameters & parameters);
+
+  virtual mfem::NonlinearFormIntegrator * createIntegrator() override;
+
+protected:
+  mfem::Coefficient & _shear_modulus;
+  mfem::Coefficient & _bulk_modulus;
+};
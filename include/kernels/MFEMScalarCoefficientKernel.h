@@ -0,0 +1,30 @@
+#pragma once
+#include "MFEMKernel.h"
+#include <optional>
+
+/*
+Base class of bilinear form kernels scaled by a scalar property k.
+*/
+class MFEMScalarCoefficientKernel : public MFEMKernel<mfem::BilinearFormIntegrator>
+{
+public:
+  static InputParameters validParams();
+
+  MFEMScalarCoefficientKernel(const InputParameters & parameters);
+
+  virtual bool isTimeDependent() const override;
+
+  virtual bool addFusedTerm(platypus::FusedIntegrator & integrator) const override;
+
+protected:
+  // Get the term of a fused integrator applying the kernel, if the kernel can be fused.
+  virtual std::optional<platypus::FusedIntegrator::Term> getFusedTerm() const
+  {
+    return std::nullopt;
+  }
+
+  std::string _coef_name;
+  // FIXME: The MFEM bilinear form can also handle vector and matrix
+  // coefficients, so ideally we'd handle all three too.
+  mfem::Coefficient & _coef;
+};
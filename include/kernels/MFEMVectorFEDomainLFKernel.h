@@ -14,6 +14,8 @@ public:
 
   virtual mfem::LinearFormIntegrator * createIntegrator() override;
 
+  virtual bool isTimeDependent() const override;
+
 protected:
   std::string _vec_coef_name;
   mfem::VectorCoefficient * _vec_coef{nullptr};
@@ -1,10 +1,10 @@
 #pragma once
-#include "MFEMKernel.h"
+#include "MFEMScalarCoefficientKernel.h"
 
 /*
 (σ u, ∇ V')
 */
-class MFEMVectorFEWeakDivergenceKernel : public MFEMKernel<mfem::BilinearFormIntegrator>
+class MFEMVectorFEWeakDivergenceKernel : public MFEMScalarCoefficientKernel
 {
 public:
   static InputParameters validParams();
@@ -13,8 +13,4 @@ public:
   ~MFEMVectorFEWeakDivergenceKernel() override = default;
 
   virtual mfem::BilinearFormIntegrator * createIntegrator() override;
-
-protected:
-  std::string _coef_name;
-  mfem::Coefficient & _coef;
 };
@@ -34,6 +34,19 @@ public:
    */
   mfem::ParMesh & getMFEMParMesh() { return *_mfem_par_mesh; };
 
+  /**
+   * Returns whether the mesh before parallel refinements is kept to build space hierarchies.
+   */
+  bool hasRefinementHierarchy() const { return _mfem_coarse_par_mesh != nullptr; }
+
+  /**
+   * Builds a hierarchy of spaces with the collection of fespace on the mesh before each parallel
+   * refinement, from the mesh before parallel refinements to the final mesh. The finest space
+   * has the same true DoFs as fespace, which must be on the final mesh.
+   */
+  std::unique_ptr<mfem::ParFiniteElementSpaceHierarchy>
+  buildFESpaceHierarchy(const mfem::ParFiniteElementSpace & fespace) const;
+
   /**
    * Build MFEM ParMesh and a placeholder MOOSE mesh.
    */
@@ -60,4 +73,9 @@ private:
    * Use the accessors instead.
    */
   std::shared_ptr<mfem::ParMesh> _mfem_par_mesh{nullptr};
+
+  /**
+   * Copy of the mesh before parallel refinements, if the refinement hierarchy is kept.
+   */
+  std::shared_ptr<mfem::ParMesh> _mfem_coarse_par_mesh{nullptr};
 };
@@ -21,7 +21,7 @@ public:
   NamedFieldsMap() = default;
 
   /// Destructor.
-  ~NamedFieldsMap() { DeregisterAll(); }
+  virtual ~NamedFieldsMap() { DeregisterAll(); }
 
   /// Construct new field with name field_name and register.
   template <class FieldType, class... FieldArgs>
@@ -38,10 +38,15 @@ public:
     Deregister(field_name);
 
     _field_map[field_name] = std::move(field);
+    OnFieldsChanged();
   }
 
   /// Unregister association between a field and the field_name.
-  void Deregister(const std::string & field_name) { _field_map.erase(field_name); }
+  void Deregister(const std::string & field_name)
+  {
+    _field_map.erase(field_name);
+    OnFieldsChanged();
+  }
 
   /// Predicate to check if a field is registered with name field_name.
   [[nodiscard]] inline bool Has(const std::string & field_name) const
@@ -103,6 +108,10 @@ public:
   [[nodiscard]] inline const_iterator end() const { return _field_map.end(); }
 
 protected:
+  /// Called whenever a field is registered or deregistered, so that derived classes can
+  /// invalidate data derived from the registered fields.
+  virtual void OnFieldsChanged() {}
+
   /// Returns a const iterator to the field.
   [[nodiscard]] inline const_iterator FindField(const std::string & field_name) const
   {
@@ -131,6 +131,12 @@ public:
    */
   InputParameters addMFEMFESpaceFromMOOSEVariable(InputParameters & moosevar_params);
 
+  /**
+   * Returns the equation system of the problem, for solvers that are built from its forms rather
+   * than from the operator they are applied to.
+   */
+  platypus::EquationSystem & getEquationSystem() const;
+
   /**
    * Method to get the PropertyManager object for storing material
    * properties and converting them to MFEM coefficients. This is used
@@ -178,4 +184,7 @@ protected:
 
   std::shared_ptr<platypus::Problem> mfem_problem{nullptr};
   std::unique_ptr<platypus::Executioner> executioner{nullptr};
+
+  /// Preconditioners added to the problem, checked for unused setup reuse when the solver is added
+  std::vector<const MFEMSolverBase *> _preconditioners;
 };
@@ -59,6 +59,9 @@ public:
   void SetCoefficients(platypus::Coefficients & coefficients);
   void SetDevice(const std::string & dev);
 
+  /// Set the convergence criteria of the nonlinear solver. Defaults to a single Newton iteration.
+  void SetNonlinearSolverOptions(int max_iterations, double rel_tol, double abs_tol);
+
   void AddFESpace(std::string fespace_name,
                   std::string fec_name,
                   int vdim = 1,
@@ -137,6 +140,11 @@ protected:
   /// Coefficient used in some derived classes.
   mfem::ConstantCoefficient _one_coef{1.0};
 
+  /// Convergence criteria of the nonlinear solver.
+  int _nl_max_iterations{1};
+  double _nl_rel_tol{0.0};
+  double _nl_abs_tol{0.0};
+
 private:
   std::shared_ptr<platypus::Problem> _problem{nullptr};
 };
@@ -155,6 +163,47 @@ public:
     GetEquationSystem()->AddKernel(var_name, std::move(kernel));
   }
 
+  /// Set the assembly level used for the bilinear forms of the equation system.
+  void SetAssemblyLevel(mfem::AssemblyLevel assembly_level)
+  {
+    GetEquationSystem()->SetAssemblyLevel(assembly_level);
+  }
+
+  /// Choose the assembly level of the equation system from its test spaces when initialised.
+  void SetAutoAssemblyLevel(int min_order)
+  {
+    GetEquationSystem()->SetAutoAssemblyLevel(min_order);
+  }
+
+  /// Set whether kernels acting on the same bilinear form are applied in a single element pass.
+  void SetFuseKernels(bool fuse_kernels) { GetEquationSystem()->SetFuseKernels(fuse_kernels); }
+
+  /// Set how often the Jacobian of nonlinear equation systems is rebuilt.
+  void SetJacobianRefresh(int refresh_iterations, int refresh_steps)
+  {
+    GetEquationSystem()->SetJacobianRefresh(refresh_iterations, refresh_steps);
+  }
+
+  /// Set whether the Jacobian of the equation system is applied by finite differences, and
+  /// whether it is then preconditioned with only the linear part of the system.
+  void SetJacobianFree(bool jacobian_free, bool precondition_with_linear_part)
+  {
+    GetEquationSystem()->SetJacobianFree(jacobian_free, precondition_with_linear_part);
+  }
+
+  /// Set whether the interior DoFs of H1 and RT variables are eliminated from the global system.
+  void SetInteriorDofElimination(bool static_condensation, bool hybridization)
+  {
+    GetEquationSystem()->SetStaticCondensation(static_condensation);
+    GetEquationSystem()->SetHybridization(hybridization);
+  }
+
+  /// Set whether the equation system is exposed as a block operator or a monolithic matrix.
+  void SetUseBlockOperator(bool use_block_operator)
+  {
+    GetEquationSystem()->SetUseBlockOperator(use_block_operator);
+  }
+
 protected:
   /// Implemented in derived classes. Returns a pointer to the problem operator's equation system.
   [[nodiscard]] virtual platypus::EquationSystem * GetEquationSystem() const = 0;
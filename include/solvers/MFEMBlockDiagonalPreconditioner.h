@@ -0,0 +1,17 @@
+#pragma once
+#include "MFEMBlockPreconditionerBase.h"
+
+/**
+ * Block diagonal preconditioner that applies a sub-solver to the diagonal block of each variable
+ * independently, ignoring couplings between variables.
+ */
+class MFEMBlockDiagonalPreconditioner : public MFEMBlockPreconditionerBase
+{
+public:
+  static InputParameters validParams();
+
+  MFEMBlockDiagonalPreconditioner(const InputParameters & parameters);
+
+protected:
+  void constructSolver(const InputParameters & parameters) override;
+};
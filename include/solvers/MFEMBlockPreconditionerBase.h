@@ -0,0 +1,27 @@
+#pragma once
+#include "MFEMSolverBase.h"
+#include "block_preconditioner.h"
+#include "mfem.hpp"
+#include <memory>
+
+/**
+ * Base class for block preconditioners of multi-variable equation systems, which apply a
+ * sub-solver to the diagonal block of each variable. Requires use_block_operator = true on the
+ * problem.
+ */
+class MFEMBlockPreconditionerBase : public MFEMSolverBase
+{
+public:
+  static InputParameters validParams();
+
+  MFEMBlockPreconditionerBase(const InputParameters & parameters);
+
+  /// Returns a shared pointer to the instance of the Solver derived-class.
+  std::shared_ptr<mfem::Solver> getSolver() const override { return _solver; }
+
+protected:
+  /// Returns the sub-solvers by the name of the variable they are applied to.
+  std::map<std::string, std::shared_ptr<mfem::Solver>> getSubSolvers() const;
+
+  std::shared_ptr<platypus::BlockPreconditioner> _solver{nullptr};
+};
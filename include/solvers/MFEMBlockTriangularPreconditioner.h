@@ -0,0 +1,18 @@
+#pragma once
+#include "MFEMBlockPreconditionerBase.h"
+
+/**
+ * Block triangular preconditioner that applies the sub-solvers of the variables in turn, in the
+ * order of the blocks of the equation system, accounting for couplings to the variables already
+ * solved for. This is a block Gauss-Seidel sweep, which is exact for triangular systems.
+ */
+class MFEMBlockTriangularPreconditioner : public MFEMBlockPreconditionerBase
+{
+public:
+  static InputParameters validParams();
+
+  MFEMBlockTriangularPreconditioner(const InputParameters & parameters);
+
+protected:
+  void constructSolver(const InputParameters & parameters) override;
+};
@@ -0,0 +1,29 @@
+#pragma once
+#include "MFEMSolverBase.h"
+#include "geometric_multigrid_solver.h"
+#include "mfem.hpp"
+#include <memory>
+
+/**
+ * Matrix-free geometric multigrid preconditioner for an H1 variable over the parallel refinements
+ * of the mesh, which must set keep_refinement_hierarchy = true. Levels are smoothed with Chebyshev
+ * iterations, and the mesh before parallel refinements is solved with AMG. Use as the
+ * preconditioner of a Krylov solver such as MFEMCGSolver, or as the sub-solver of the variable in
+ * a block preconditioner.
+ */
+class MFEMGeometricMultigrid : public MFEMSolverBase
+{
+public:
+  static InputParameters validParams();
+
+  MFEMGeometricMultigrid(const InputParameters & parameters);
+
+  /// Returns a shared pointer to the instance of the Solver derived-class.
+  std::shared_ptr<mfem::Solver> getSolver() const override { return _solver; }
+
+protected:
+  void constructSolver(const InputParameters & parameters) override;
+
+private:
+  std::shared_ptr<platypus::GeometricMultigridSolver> _solver{nullptr};
+};
@@ -0,0 +1,27 @@
+#pragma once
+#include "MFEMSolverBase.h"
+#include "lor_solver.h"
+#include "mfem.hpp"
+#include <memory>
+
+/**
+ * Preconditioner for a high-order variable built from a low-order-refined discretization of its
+ * bilinear forms. Use as the preconditioner of a Krylov solver such as MFEMCGSolver, or as the
+ * sub-solver of the variable in a block preconditioner.
+ */
+class MFEMLORSolver : public MFEMSolverBase
+{
+public:
+  static InputParameters validParams();
+
+  MFEMLORSolver(const InputParameters & parameters);
+
+  /// Returns a shared pointer to the instance of the Solver derived-class.
+  std::shared_ptr<mfem::Solver> getSolver() const override { return _solver; }
+
+protected:
+  void constructSolver(const InputParameters & parameters) override;
+
+private:
+  std::shared_ptr<platypus::LORSolver> _solver{nullptr};
+};
@@ -0,0 +1,27 @@
+#pragma once
+#include "MFEMSolverBase.h"
+#include "p_multigrid_solver.h"
+#include "mfem.hpp"
+#include <memory>
+
+/**
+ * Matrix-free p-multigrid preconditioner for a high-order H1 variable, with Chebyshev smoothing
+ * on each order and an AMG coarse solve on order 1. Use as the preconditioner of a Krylov solver
+ * such as MFEMCGSolver, or as the sub-solver of the variable in a block preconditioner.
+ */
+class MFEMPMultigrid : public MFEMSolverBase
+{
+public:
+  static InputParameters validParams();
+
+  MFEMPMultigrid(const InputParameters & parameters);
+
+  /// Returns a shared pointer to the instance of the Solver derived-class.
+  std::shared_ptr<mfem::Solver> getSolver() const override { return _solver; }
+
+protected:
+  void constructSolver(const InputParameters & parameters) override;
+
+private:
+  std::shared_ptr<platypus::PMultigridSolver> _solver{nullptr};
+};
@@ -1,5 +1,6 @@
 #pragma once
 #include "MFEMGeneralUserObject.h"
+#include "setup_reuse_solver.h"
 #include "mfem.hpp"
 #include <memory>
 
@@ -16,7 +17,26 @@ public:
   /// Returns a shared pointer to the instance of the Solver derived-class.
   virtual std::shared_ptr<mfem::Solver> getSolver() const = 0;
 
+  /// Returns the solver to apply to an equation system. If a setup reuse policy is set, this wraps
+  /// the solver so that its setup is kept across operators until the policy requires it to be
+  /// redone.
+  std::shared_ptr<mfem::Solver> getReusableSolver() const;
+
+  /// Returns true if a policy for reusing the setup of the solver is set.
+  bool hasSetupReuse() const { return _setup_reuse_policy != platypus::SetupReusePolicy::NEVER; }
+
+  /// Returns true if the solver has been wrapped for setup reuse by getReusableSolver.
+  bool setupReuseIsApplied() const { return _reusable_solver != nullptr; }
+
 protected:
   /// Override in derived classes to construct and set the solver options.
   virtual void constructSolver(const InputParameters & parameters) = 0;
+
+  /// Raise an error if the preconditioner of a hypre Krylov solver reuses its setup, since hypre
+  /// redoes the setup of the preconditioner whenever the Krylov solver is set up.
+  void checkHyprePreconditionerReuse() const;
+
+private:
+  platypus::SetupReusePolicy _setup_reuse_policy;
+  mutable std::shared_ptr<platypus::SetupReuseSolver> _reusable_solver{nullptr};
 };
@@ -0,0 +1,42 @@
+#pragma once
+#include "variable_block_operator.h"
+#include <map>
+#include <memory>
+
+namespace platypus
+{
+
+/// Ways in which the sub-solvers of a block preconditioner are combined.
+enum class BlockPreconditionerType
+{
+  DIAGONAL,         // Apply each sub-solver to its block of the input independently.
+  LOWER_TRIANGULAR, // Solve for blocks in order, subtracting couplings to earlier blocks.
+  UPPER_TRIANGULAR  // Solve for blocks in reverse order, subtracting couplings to later blocks.
+};
+
+/*
+Field-split preconditioner for equation systems exposed as a VariableBlockOperator. Each
+diagonal block is approximately inverted by the sub-solver of its variable, which is set up with
+that block alone; triangular variants also apply the off-diagonal coupling blocks of the operator.
+*/
+class BlockPreconditioner : public mfem::Solver
+{
+public:
+  BlockPreconditioner(BlockPreconditionerType type,
+                      std::map<std::string, std::shared_ptr<mfem::Solver>> solvers);
+
+  void SetOperator(const mfem::Operator & op) override;
+
+  void Mult(const mfem::Vector & x, mfem::Vector & y) const override;
+
+private:
+  BlockPreconditionerType _type;
+  // Sub-solvers by variable name
+  std::map<std::string, std::shared_ptr<mfem::Solver>> _solvers;
+  // Sub-solvers in block order of the current operator
+  std::vector<mfem::Solver *> _block_solvers;
+  mfem::BlockOperator * _block_op{nullptr};
+  mutable mfem::Vector _residual;
+};
+
+} // namespace platypus
@@ -0,0 +1,33 @@
+#pragma once
+#include "multigrid_solver.h"
+
+namespace platypus
+{
+
+/*
+Matrix-free geometric multigrid preconditioner for the diagonal block of an H1 variable, on a
+hierarchy of spaces of the same order over uniform refinements of a coarse mesh. The coarsest
+level is assembled on the coarse mesh, so the memory needed by the preconditioner is dominated by
+the partially assembled forms rather than by algebraic multigrid setup on the fine mesh.
+*/
+class GeometricMultigridSolver : public MultigridSolver
+{
+public:
+  using HierarchyBuilder = std::function<std::unique_ptr<mfem::ParFiniteElementSpaceHierarchy>(
+      const mfem::ParFiniteElementSpace &)>;
+
+  GeometricMultigridSolver(std::function<const EquationSystem &()> get_equation_system,
+                           HierarchyBuilder build_hierarchy,
+                           std::string variable_name,
+                           int chebyshev_order,
+                           int print_level);
+
+protected:
+  std::unique_ptr<mfem::ParFiniteElementSpaceHierarchy>
+  BuildHierarchy(const mfem::ParFiniteElementSpace & fespace) override;
+
+private:
+  HierarchyBuilder _build_hierarchy;
+};
+
+} // namespace platypus
@@ -0,0 +1,46 @@
+#pragma once
+#include "equation_system.h"
+#include <functional>
+#include <memory>
+
+namespace platypus
+{
+
+/*
+Preconditioner for the diagonal block of a high-order variable, built from a low-order-refined
+(LOR) discretization of its bilinear forms on the same mesh. The integrators of the forms are
+assembled on a low-order space over a refinement of each element with a vertex at every high-order
+node, giving a sparse matrix that is spectrally equivalent to the high-order block and much
+cheaper to set up AMG for. The sparse matrix is preconditioned with BoomerAMG for H1 and L2
+variables, AMS for ND and 2D RT variables and ADS for 3D RT variables. ND and RT variables are
+only supported when their block is a single unweighted form, as in steady problems. The high-order
+block itself is only applied by the Krylov solver, so may be matrix-free.
+
+The equation system is looked up when the solver is set up, since solvers may be constructed
+before the equation system they are applied to.
+*/
+class LORSolver : public mfem::Solver
+{
+public:
+  LORSolver(std::function<const EquationSystem &()> get_equation_system,
+            std::string variable_name,
+            int print_level);
+
+  /// Discretize the forms of the variable on the LOR space and set up the sparse solver. The
+  /// operator must be the diagonal block of the variable, but is otherwise unused.
+  void SetOperator(const mfem::Operator & op) override;
+
+  void Mult(const mfem::Vector & x, mfem::Vector & y) const override;
+
+private:
+  std::function<const EquationSystem &()> _get_equation_system;
+  std::string _variable_name;
+  int _print_level;
+
+  // Used to sum the LOR discretizations of several forms
+  std::unique_ptr<mfem::ParLORDiscretization> _lor;
+  std::unique_ptr<mfem::HypreParMatrix> _lor_matrix;
+  std::unique_ptr<mfem::Solver> _solver;
+};
+
+} // namespace platypus
@@ -0,0 +1,81 @@
+#pragma once
+#include "equation_system.h"
+#include <functional>
+#include <memory>
+
+namespace platypus
+{
+
+/*
+Base class of matrix-free multigrid preconditioners for the diagonal block of an H1 variable. The
+bilinear forms of the variable are rediscretized on each space of a hierarchy built by the derived
+class, the finest of which has the same true DoFs as the variable. Levels above the coarsest are
+applied with partial assembly and smoothed with Chebyshev-accelerated Jacobi iterations, which
+only need the diagonal of the operator. The coarsest level is fully assembled and solved with a
+single BoomerAMG V-cycle, so the preconditioner is a fixed linear operator suitable for CG.
+
+The hierarchy, the forms of each level and the coarse solver are built when the solver is first
+set up. Later setups reassemble the forms with their current weights and set up the coarse solver
+and smoothers again.
+
+The equation system is looked up when the solver is set up, since solvers may be constructed
+before the equation system they are applied to.
+*/
+class MultigridSolver : public mfem::Solver
+{
+public:
+  MultigridSolver(std::function<const EquationSystem &()> get_equation_system,
+                  std::string variable_name,
+                  int chebyshev_order,
+                  int print_level);
+
+  /// Reassemble the forms of the variable on each level and set up the smoothers and coarse
+  /// solver. The operator must be the diagonal block of the variable, but is otherwise unused.
+  void SetOperator(const mfem::Operator & op) override;
+
+  void Mult(const mfem::Vector & x, mfem::Vector & y) const override;
+
+  /// Returns the hierarchy of spaces, which is built when the solver is first set up.
+  const mfem::ParFiniteElementSpaceHierarchy & GetHierarchy() const
+  {
+    MFEM_VERIFY(_hierarchy,
+                "The multigrid solver of variable " << _variable_name << " has not been set up.");
+    return *_hierarchy;
+  }
+
+protected:
+  /// Build the hierarchy of spaces from the space of the variable, once on the first setup.
+  virtual std::unique_ptr<mfem::ParFiniteElementSpaceHierarchy>
+  BuildHierarchy(const mfem::ParFiniteElementSpace & fespace) = 0;
+
+  std::string _variable_name;
+  // Collections created for the levels of the hierarchy, which must outlive it
+  std::vector<std::unique_ptr<mfem::FiniteElementCollection>> _fecs;
+
+private:
+  /// Create the forms of variable i on each level of the hierarchy, once on the first setup.
+  void BuildLevels(const EquationSystem & equation_system, int i);
+
+  /// Assemble the forms of each level with the given weights, and set up the level operators,
+  /// smoothers and coarse solver.
+  void AssembleLevels(const std::vector<double> & scales);
+
+  std::function<const EquationSystem &()> _get_equation_system;
+  int _chebyshev_order;
+  int _print_level;
+
+  std::unique_ptr<mfem::ParFiniteElementSpaceHierarchy> _hierarchy;
+  // Forms of each level, and their true DoF operators on the levels above the coarsest
+  std::vector<std::vector<std::unique_ptr<mfem::ParBilinearForm>>> _forms;
+  std::vector<std::vector<std::unique_ptr<mfem::Operator>>> _form_operators;
+  std::vector<mfem::Array<int>> _ess_tdof_lists;
+  // Assembled operator and AMG solver of the coarsest level
+  std::unique_ptr<mfem::HypreParMatrix> _coarse_matrix;
+  std::unique_ptr<mfem::HypreBoomerAMG> _coarse_solver;
+  // Weighted sums of the form operators of the levels above the coarsest, and their smoothers
+  std::vector<std::unique_ptr<mfem::Operator>> _operators;
+  std::vector<std::unique_ptr<mfem::Solver>> _smoothers;
+  std::unique_ptr<mfem::Multigrid> _multigrid;
+};
+
+} // namespace platypus
@@ -0,0 +1,22 @@
+#pragma once
+#include "multigrid_solver.h"
+
+namespace platypus
+{
+
+/*
+Matrix-free p-multigrid preconditioner for the diagonal block of a high-order H1 variable, on a
+hierarchy of spaces on the same mesh with decreasing order, roughly halving at each level down to
+order 1.
+*/
+class PMultigridSolver : public MultigridSolver
+{
+public:
+  using MultigridSolver::MultigridSolver;
+
+protected:
+  std::unique_ptr<mfem::ParFiniteElementSpaceHierarchy>
+  BuildHierarchy(const mfem::ParFiniteElementSpace & fespace) override;
+};
+
+} // namespace platypus
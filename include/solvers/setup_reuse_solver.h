@@ -0,0 +1,61 @@
+#pragma once
+#include "mfem.hpp"
+#include <memory>
+
+namespace platypus
+{
+
+/// Policies deciding when the setup of a solver is redone for a new operator.
+enum class SetupReusePolicy
+{
+  NEVER,         // Redo the setup for every new operator.
+  STEPS,         // Redo the setup every fixed number of new operators.
+  MATRIX_CHANGE, // Redo the setup when the matrix has changed by more than a relative tolerance.
+  ITERATIONS     // Redo the setup when the last solve took more than a number of applications.
+};
+
+/*
+Wraps a solver, typically a preconditioner such as an AMG hierarchy, so that the setup performed
+for one operator is kept for later operators until the reuse policy requires it to be redone.
+Used as the preconditioner of a Krylov solver, the Krylov solver still applies the new operator,
+so reuse only affects the number of iterations. Used as the Jacobian solver, a reused setup gives
+an approximate solve, so the nonlinear solver needs several iterations to converge.
+
+The setup is only reused for HypreParMatrix operators. The matrix is copied when the setup is
+redone, since the operator passed in may be destroyed before the next setup. The reuse decision
+only depends on global quantities, so is the same on all ranks.
+*/
+class SetupReuseSolver : public mfem::Solver
+{
+public:
+  SetupReuseSolver(std::shared_ptr<mfem::Solver> solver,
+                   SetupReusePolicy policy,
+                   int steps,
+                   double matrix_tolerance,
+                   int iterations);
+
+  void SetOperator(const mfem::Operator & op) override;
+
+  void Mult(const mfem::Vector & x, mfem::Vector & y) const override;
+
+  /// Returns the number of times the setup of the wrapped solver has been performed.
+  int NumSetups() const { return _num_setups; }
+
+private:
+  /// Returns true if the setup for the stored matrix should be redone for matrix.
+  bool SetupIsStale(const mfem::HypreParMatrix & matrix) const;
+
+  std::shared_ptr<mfem::Solver> _solver;
+  SetupReusePolicy _policy;
+  int _steps;
+  double _matrix_tolerance;
+  int _iterations;
+
+  // Copy of the matrix the wrapped solver was last set up with
+  std::unique_ptr<mfem::HypreParMatrix> _setup_matrix;
+  int _operators_since_setup{0};
+  mutable int _applications_since_operator{0};
+  int _num_setups{0};
+};
+
+} // namespace platypus
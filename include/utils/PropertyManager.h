@@ -34,7 +34,8 @@ public:
                      const std::vector<std::string> & blocks = {});
   void declareScalar(const std::string & name,
                      std::unique_ptr<mfem::Coefficient> && coef,
-                     const std::vector<std::string> & blocks = {});
+                     const std::vector<std::string> & blocks = {},
+                     bool time_dependent = true);
 
   void declareVector(const std::string & name,
                      const mfem::Vector & value,
@@ -49,7 +50,8 @@ public:
                      const std::vector<std::string> & blocks = {});
   void declareVector(const std::string & name,
                      std::unique_ptr<mfem::VectorCoefficient> && coef,
-                     const std::vector<std::string> & blocks = {});
+                     const std::vector<std::string> & blocks = {},
+                     bool time_dependent = true);
 
   void declareMatrix(const std::string & name,
                      const mfem::DenseMatrix & value,
@@ -65,7 +67,8 @@ public:
                 const std::vector<std::string> & blocks = {});
   void declareMatrix(const std::string & name,
                      std::unique_ptr<mfem::MatrixCoefficient> && coef,
-                     const std::vector<std::string> & blocks = {});
+                     const std::vector<std::string> & blocks = {},
+                     bool time_dependent = true);
 
   mfem::Coefficient & getScalarProperty(const std::string name);
   mfem::VectorCoefficient & getVectorProperty(const std::string name);
@@ -73,6 +76,9 @@ public:
   bool scalarIsDefined(const std::string & name, const std::string & block) const;
   bool vectorIsDefined(const std::string & name, const std::string & block) const;
   bool matrixIsDefined(const std::string & name, const std::string & block) const;
+  bool scalarIsTimeDependent(const std::string & name) const;
+  bool vectorIsTimeDependent(const std::string & name) const;
+  bool matrixIsTimeDependent(const std::string & name) const;
 
 private:
   ScalarMap _scalar_coeffs;
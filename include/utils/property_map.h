@@ -1,6 +1,7 @@
 #pragma once
 #include <map>
 #include <memory>
+#include <set>
 #include <string>
 #include <tuple>
 #include <utility>
@@ -23,7 +24,9 @@ template <class T, class Tpw>
 class PropertyMap
 {
 public:
-  void addProperty(const std::string & name, std::unique_ptr<T> && coeff)
+  void addProperty(const std::string & name,
+                   std::unique_ptr<T> && coeff,
+                   bool time_dependent = true)
   {
     const auto [_, inserted] = this->_properties.emplace(name, std::move(coeff));
     if (!inserted)
@@ -31,13 +34,18 @@ public:
       throw MooseException("Property with name '" + name +
                            "' already present in PropertyMap object");
     }
+    if (time_dependent)
+    {
+      this->_time_dependent_properties.insert(name);
+    }
   }
 
   // Note: If you attempt to overwrite an existing block then an exception will be thrown and data
   // for that property will be left in an undefined state.
   void addPiecewiseBlocks(const std::string & name,
                           std::shared_ptr<T> coeff,
-                          const std::vector<std::string> & blocks)
+                          const std::vector<std::string> & blocks,
+                          bool time_dependent = true)
   {
     // Initialise property with empty coefficients, if it does not already exist
     if (!this->hasCoefficient(name))
@@ -64,6 +72,10 @@ public:
       coeff_map[block] = coeff;
       pw_coeff.UpdateCoefficient(std::stoi(block), *coeff);
     }
+    if (time_dependent)
+    {
+      this->_time_dependent_properties.insert(name);
+    }
   }
 
   T & getCoefficient(const std::string & name)
@@ -88,6 +100,13 @@ public:
 
   bool hasCoefficient(const std::string & name) const { return this->_properties.count(name) > 0; }
 
+  // Returns true if the property may vary in time on any block. Properties that have not been
+  // declared are not time-dependent.
+  bool isTimeDependent(const std::string & name) const
+  {
+    return this->_time_dependent_properties.count(name) > 0;
+  }
+
   bool coefficientDefinedOnBlock(const std::string & name, const std::string & block) const
   {
     if (!this->hasCoefficient(name))
@@ -102,6 +121,7 @@ public:
 private:
   using PWData = std::tuple<Tpw, std::map<const std::string, std::shared_ptr<T>>>;
   std::map<const std::string, std::variant<std::unique_ptr<T>, PWData>> _properties;
+  std::set<std::string> _time_dependent_properties;
 
   PWData emptyPWData(std::shared_ptr<T> coeff) { return PWData(); }
   void checkPWData(std::shared_ptr<T> coeff, Tpw & existing_pw, const std::string & name) {}
@@ -7,5 +7,16 @@ MFEM_LIBS 			:= -L$(MFEM_DIR) -lmfem -lrt -L$(MFEM_DIR)/miniapps/common -lmfem-c
 ADDITIONAL_INCLUDES += $(MFEM_INCLUDES)
 ADDITIONAL_LIBS 	+= -Wl, $(MFEM_LIBS)
 
+# Set PLATYPUS_OPENMP=yes to assemble forms over OpenMP threads within each MPI rank. Threaded
+# assembly also requires MFEM to be configured with MFEM_THREAD_SAFE=YES, and is otherwise serial.
+PLATYPUS_OPENMP		?= no
+ifeq ($(PLATYPUS_OPENMP),yes)
+  ADDITIONAL_CPPFLAGS += -fopenmp
+  ADDITIONAL_LIBS 	+= -fopenmp
+  ifneq ($(MFEM_THREAD_SAFE),YES)
+    $(warning PLATYPUS_OPENMP=yes has no effect unless MFEM is built with MFEM_THREAD_SAFE=YES)
+  endif
+endif
+
 $(info ADDITIONAL_INCLUDES = $(ADDITIONAL_INCLUDES));
 $(info ADDITIONAL_LIBS     = $(ADDITIONAL_LIBS));
\ No newline at end of file
@@ -0,0 +1,96 @@
+#pragma once
+
+#include "MFEMObjectUnitTest.h"
+#include "equation_system.h"
+
+/**
+ * Base class for unit tests that build and solve equation systems from MFEM kernels. Kernels are
+ * added to the problem and to the equation system, and the variables of the equation system are
+ * gridfunctions on spaces built by the test.
+ */
+class MFEMEquationSystemUnitTest : public MFEMObjectUnitTest
+{
+public:
+  MFEMEquationSystemUnitTest(const std::string & app_name) : MFEMObjectUnitTest(app_name) {}
+
+protected:
+  /**
+   * Add a kernel to the problem, and to the equation system of its variable.
+   */
+  template <typename T>
+  T & addKernel(platypus::EquationSystem & equation_system,
+                const std::string & type,
+                const std::string & name,
+                InputParameters & params)
+  {
+    T & kernel = addObject<T>(type, name, params);
+    equation_system.AddKernel(kernel.getTestVariableName(),
+                              std::dynamic_pointer_cast<T>(kernel.getSharedPtr()));
+    return kernel;
+  }
+
+  /**
+   * Add a variable on the space to the gridfunctions, initialised to zero.
+   */
+  mfem::ParGridFunction & addVariable(const std::string & name,
+                                      mfem::ParFiniteElementSpace & fespace)
+  {
+    _gridfunctions.Register(name, std::make_shared<mfem::ParGridFunction>(&fespace));
+    _gridfunctions.GetRef(name) = 0.0;
+    return _gridfunctions.GetRef(name);
+  }
+
+  /**
+   * Apply a Dirichlet condition with the coefficient on the whole boundary of the variable.
+   */
+  void addDirichletBC(const std::string & variable,
+                      mfem::ParMesh & mesh,
+                      mfem::Coefficient & coefficient)
+  {
+    _bc_map.Register(variable + "_bc",
+                     std::make_shared<platypus::ScalarDirichletBC>(
+                         variable, mesh.bdr_attributes, &coefficient));
+  }
+
+  /**
+   * Initialise and build the equation system, and solve it with CG to a relative tolerance,
+   * preconditioned by the preconditioner if given. The solution is stored in the gridfunctions.
+   * Returns the number of iterations taken.
+   */
+  int solve(platypus::EquationSystem & equation_system,
+            mfem::Solver * preconditioner,
+            mfem::real_t tol)
+  {
+    equation_system.Init(_gridfunctions, _fespaces, _bc_map);
+    equation_system.BuildEquationSystem(_bc_map);
+
+    const auto & fespaces = equation_system._test_pfespaces;
+    mfem::Array<int> offsets(fespaces.size() + 1);
+    offsets[0] = 0;
+    for (std::size_t i = 0; i < fespaces.size(); i++)
+    {
+      offsets[i + 1] = offsets[i] + fespaces[i]->GetTrueVSize();
+    }
+    mfem::BlockVector trueX(offsets), trueRHS(offsets);
+    mfem::OperatorHandle op;
+    equation_system.FormLinearSystem(op, trueX, trueRHS);
+
+    mfem::CGSolver cg(MPI_COMM_WORLD);
+    cg.SetRelTol(tol);
+    cg.SetMaxIter(1000);
+    if (preconditioner)
+    {
+      cg.SetPreconditioner(*preconditioner);
+    }
+    cg.SetOperator(*op);
+    cg.Mult(trueRHS, trueX);
+    EXPECT_TRUE(cg.GetConverged());
+
+    equation_system.RecoverFEMSolution(trueX, _gridfunctions);
+    return cg.GetNumIterations();
+  }
+
+  platypus::GridFunctions _gridfunctions;
+  platypus::FESpaces _fespaces;
+  platypus::BCMap _bc_map;
+};